@@ -0,0 +1,468 @@
+#ifndef AISDI_LINEAR_COMPACTLIST_H
+#define AISDI_LINEAR_COMPACTLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+    //lista dwukierunkowa, ktorej wezly leza w jednej tablicy i wskazuja sie indeksami
+    //wezel 0 to wartownik (end()), jego next to pierwszy element, a prev - ostatni
+    //wolne wezly tworza liste jednokierunkowa po next, zaczynajaca sie w free_head
+    //powiekszenie puli przenosi wartosci (referencje traca waznosc), iteratory trzymaja indeksy i zostaja wazne
+    template <typename Type, typename IndexType = std::uint32_t>
+    class CompactList
+    {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        using index_type = IndexType;
+
+        static_assert(std::is_unsigned<IndexType>::value, "IndexType must be an unsigned integer");
+
+        class ConstIterator;
+        class Iterator;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        struct Node {
+            IndexType prev;
+            IndexType next;
+            typename std::aligned_storage<sizeof(Type), alignof(Type)>::type value;
+        };
+
+        CompactList() : size(0), capacity(FIRST_SIZE), free_head(SENTINEL) {
+            nodes = new Node[capacity];
+            nodes[SENTINEL].next = nodes[SENTINEL].prev = SENTINEL;
+            pushFree(1, capacity);
+        }
+
+        CompactList(std::initializer_list<Type> l) : CompactList() {
+            for (const auto& val : l) {
+                insert(end(), val);
+            }
+        }
+
+        CompactList(const CompactList& other) : CompactList() {
+            for (auto it = other.begin(); it != other.end(); ++it) {
+                insert(end(), *it);
+            }
+        }
+
+        CompactList(CompactList&& other) : CompactList() {
+            swap(other);
+        }
+
+        ~CompactList() {
+            destroyAll();
+            delete[] nodes;
+        }
+
+        CompactList& operator=(const CompactList& other) {
+            if (this == &other) {
+                return *this;
+            }
+            erase(cbegin(), cend());
+            for (auto it = other.begin(); it != other.end(); ++it) {
+                insert(end(), *it);
+            }
+            return *this;
+        }
+
+        CompactList& operator=(CompactList&& other) {
+            if (this == &other) {
+                return *this;
+            }
+            erase(cbegin(), cend());
+            swap(other);
+            return *this;
+        }
+
+        bool isEmpty() const {
+            return size == 0;
+        }
+
+        size_type getSize() const {
+            return size;
+        }
+
+        void append(const Type& item) {
+            insert(end(), item);
+        }
+
+        void prepend(const Type& item) {
+            insert(begin(), item);
+        }
+
+        //wstawianie elementu przed elementem wskazywanym przez iterator
+        void insert(const const_iterator& insertPosition, const Type& item) {
+            IndexType new_node;
+            if (free_head == SENTINEL) {
+                new_node = grow(item);
+            }
+            else {
+                new_node = free_head;
+                new (valuePointer(new_node)) Type(item);
+                free_head = nodes[new_node].next;
+            }
+
+            IndexType next = insertPosition.get();
+            IndexType prev = nodes[next].prev;
+            nodes[new_node].next = next;
+            nodes[new_node].prev = prev;
+            nodes[prev].next = new_node;
+            nodes[next].prev = new_node;
+            ++size;
+        }
+
+        Type popFirst() {
+            if (isEmpty()) {
+                throw std::logic_error("List is empty");
+            }
+            Type ret_val = *begin();
+            erase(begin());
+            return ret_val;
+        }
+
+        Type popLast() {
+            if (isEmpty()) {
+                throw std::logic_error("List is empty");
+            }
+            Type ret_val = *(--end());
+            erase(--end());
+            return ret_val;
+        }
+
+        void erase(const const_iterator& position) {
+            if (position == end()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            eraseNode(position.get());
+        }
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            IndexType current = firstIncluded.get();
+            while (current != lastExcluded.get()) {
+                IndexType next = nodes[current].next;
+                eraseNode(current);
+                current = next;
+            }
+        }
+
+        //przenumerowuje wezly w kolejnosci listy (1, 2, ...), zeby przeglad szedl po kolejnych adresach
+        //uniewaznia wszystkie iteratory
+        void compact() {
+            Node* new_nodes = new Node[capacity];
+            IndexType new_index = 1;
+            try {
+                for (IndexType current = nodes[SENTINEL].next; current != SENTINEL; current = nodes[current].next) {
+                    new (&new_nodes[new_index].value) Type(std::move_if_noexcept(*valuePointer(current)));
+                    new_nodes[new_index].prev = new_index - 1;
+                    new_nodes[new_index].next = new_index + 1;
+                    ++new_index;
+                }
+            }
+            catch (...) {
+                for (IndexType i = 1; i < new_index; ++i) {
+                    reinterpret_cast<pointer>(&new_nodes[i].value)->~Type();
+                }
+                delete[] new_nodes;
+                throw;
+            }
+            destroyAll();
+            delete[] nodes;
+            nodes = new_nodes;
+            nodes[SENTINEL].next = size > 0 ? 1 : SENTINEL;
+            nodes[SENTINEL].prev = static_cast<IndexType>(size);
+            if (size > 0) {
+                nodes[size].next = SENTINEL;
+            }
+            free_head = SENTINEL;
+            pushFree(static_cast<IndexType>(size + 1), capacity);
+        }
+
+        iterator begin()
+        {
+            return iterator(nodes[SENTINEL].next, *this);
+        }
+
+        iterator end()
+        {
+            return iterator(SENTINEL, *this);
+        }
+
+        const_iterator cbegin() const
+        {
+            return const_iterator(nodes[SENTINEL].next, *this);
+        }
+
+        const_iterator cend() const
+        {
+            return const_iterator(SENTINEL, *this);
+        }
+
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+    private:
+        static const IndexType SENTINEL = 0;
+        static const IndexType FIRST_SIZE = 16;
+
+        pointer valuePointer(IndexType index) const {
+            return reinterpret_cast<pointer>(&nodes[index].value);
+        }
+
+        //dokleja wezly [from, to) na poczatek listy wolnych, tak by byly pobierane rosnaco
+        void pushFree(IndexType from, IndexType to) {
+            for (IndexType i = to; i > from; --i) {
+                nodes[i - 1].next = free_head;
+                free_head = i - 1;
+            }
+        }
+
+        void eraseNode(IndexType index) {
+            nodes[nodes[index].prev].next = nodes[index].next;
+            nodes[nodes[index].next].prev = nodes[index].prev;
+            valuePointer(index)->~Type();
+            nodes[index].next = free_head;
+            free_head = index;
+            --size;
+        }
+
+        //powieksza pule i tworzy item w pierwszym nowym wezle (zwraca jego indeks)
+        //item jest kopiowany zanim stara pula zostanie zwolniona, wiec moze byc elementem tej listy
+        IndexType grow(const Type& item) {
+            const IndexType max_capacity = std::numeric_limits<IndexType>::max();
+            if (capacity == max_capacity) {
+                throw std::length_error("CompactList is full");
+            }
+            IndexType new_capacity = capacity > max_capacity / 2 ? max_capacity : capacity * 2;
+            Node* new_nodes = new Node[new_capacity];
+            IndexType new_node = capacity;
+            try {
+                new (&new_nodes[new_node].value) Type(item);
+            }
+            catch (...) {
+                delete[] new_nodes;
+                throw;
+            }
+            IndexType current = nodes[SENTINEL].next;
+            try {
+                for (; current != SENTINEL; current = nodes[current].next) {
+                    new (&new_nodes[current].value) Type(std::move_if_noexcept(*valuePointer(current)));
+                }
+            }
+            catch (...) {
+                for (IndexType i = nodes[SENTINEL].next; i != current; i = nodes[i].next) {
+                    reinterpret_cast<pointer>(&new_nodes[i].value)->~Type();
+                }
+                reinterpret_cast<pointer>(&new_nodes[new_node].value)->~Type();
+                delete[] new_nodes;
+                throw;
+            }
+            for (IndexType i = 0; i < capacity; ++i) {
+                new_nodes[i].prev = nodes[i].prev;
+                new_nodes[i].next = nodes[i].next;
+            }
+            destroyAll();
+            delete[] nodes;
+            nodes = new_nodes;
+            pushFree(capacity + 1, new_capacity);
+            capacity = new_capacity;
+            return new_node;
+        }
+
+        void destroyAll() {
+            if (std::is_trivially_destructible<Type>::value) {
+                return;
+            }
+            for (IndexType current = nodes[SENTINEL].next; current != SENTINEL; current = nodes[current].next) {
+                valuePointer(current)->~Type();
+            }
+        }
+
+        void swap(CompactList& other) {
+            std::swap(nodes, other.nodes);
+            std::swap(size, other.size);
+            std::swap(capacity, other.capacity);
+            std::swap(free_head, other.free_head);
+        }
+
+        Node* nodes;
+        size_type size;
+        IndexType capacity;
+        IndexType free_head;
+    };
+
+    template <typename Type, typename IndexType>
+    const IndexType CompactList<Type, IndexType>::SENTINEL;
+
+    template <typename Type, typename IndexType>
+    const IndexType CompactList<Type, IndexType>::FIRST_SIZE;
+
+    template <typename Type, typename IndexType>
+    class CompactList<Type, IndexType>::ConstIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename CompactList::value_type;
+        using difference_type = typename CompactList::difference_type;
+        using pointer = typename CompactList::const_pointer;
+        using reference = typename CompactList::const_reference;
+
+        explicit ConstIterator(IndexType index, const CompactList& parent) : index(index), parent(parent) {}
+
+        reference operator*() const {
+            if (*this == parent.end()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            return *parent.valuePointer(index);
+        }
+
+        IndexType get() const {
+            return index;
+        }
+
+        ConstIterator& operator++() {
+            if (*this == parent.end()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            index = parent.nodes[index].next;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        ConstIterator& operator--() {
+            if (*this == parent.begin()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            index = parent.nodes[index].prev;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator result = *this;
+            --(*this);
+            return result;
+        }
+
+        ConstIterator& operator+=(difference_type d) {
+            for (difference_type i = 0; i < d; ++i)
+                ++(*this);
+            return *this;
+        }
+
+        ConstIterator& operator-=(difference_type d) {
+            for (difference_type i = 0; i < d; ++i)
+                --(*this);
+            return *this;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            ConstIterator new_iter = *this;
+            new_iter += d;
+            return new_iter;
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            ConstIterator new_iter = *this;
+            new_iter -= d;
+            return new_iter;
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return index == other.index;
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        IndexType index;
+        const CompactList& parent;
+    };
+
+    template <typename Type, typename IndexType>
+    class CompactList<Type, IndexType>::Iterator : public CompactList<Type, IndexType>::ConstIterator
+    {
+    public:
+        using pointer = typename CompactList::pointer;
+        using reference = typename CompactList::reference;
+
+        explicit Iterator(IndexType index, const CompactList& parent) : ConstIterator(index, parent) {}
+
+        Iterator(const ConstIterator& other)
+                : ConstIterator(other)
+        {}
+
+        Iterator& operator++()
+        {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--()
+        {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const
+        {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const
+        {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const
+        {
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_COMPACTLIST_H
@@ -0,0 +1,434 @@
+#ifndef AISDI_LINEAR_FLATSET_H
+#define AISDI_LINEAR_FLATSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+    //Sorted - bezgalezne wyszukiwanie binarne bezposrednio w posortowanym wektorze
+    //Eytzinger - dodatkowa kopia kluczy w ukladzie kopca (wezel k ma dzieci 2k i 2k+1),
+    //            kolejne poziomy wyszukiwania leza obok siebie w pamieci; budowana przez insertBatch()
+    //            i buildIndex(), uzywana tylko przez wyszukiwania (find, contains, lower_bound, ...);
+    //            po insert/erase wyszukiwania ida jak w Sorted az do buildIndex()
+    //            metody const niczego nie zapisuja - const FlatSet mozna czytac z wielu watkow
+    //            oplaca sie dla zbiorow wiekszych od pamieci podrecznej (5M intow: ok. 2x szybciej),
+    //            przy 500k wychodzi na remis, a dla malych zbiorow (100k) jest nieco wolniejsza niz Sorted
+    enum class SearchLayout {
+        Sorted,
+        Eytzinger
+    };
+
+    //posortowany wektor elementow bez powtorzen klucza; KeyOf wyciaga klucz z elementu
+    //wspolna czesc FlatSet i FlatMap
+    template <typename Element, typename Key, typename KeyOf, typename Compare, SearchLayout Layout>
+    class FlatTable {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using key_type = Key;
+        using value_type = Element;
+        using const_reference = const Element&;
+
+        using const_iterator = typename Vector<Element>::const_iterator;
+        using iterator = const_iterator;
+
+        FlatTable() : eytzinger_nodes(nullptr), index_dirty(true) {}
+
+        explicit FlatTable(const Compare& compare) : compare(compare), eytzinger_nodes(nullptr), index_dirty(true) {}
+
+        //kopia buduje wlasny uklad Eytzingera (wskaznik oryginalu wskazuje na jego bufor)
+        FlatTable(const FlatTable& other)
+                : items(other.items), compare(other.compare), key_of(other.key_of),
+                  eytzinger_nodes(nullptr), index_dirty(true) {
+            if (!other.index_dirty) {
+                buildIndex();
+            }
+        }
+
+        //przeniesienie std::vector zachowuje bufor, wiec wskaznik na wyrownany wezel zostaje wazny
+        FlatTable(FlatTable&& other)
+                : items(std::move(other.items)), compare(other.compare), key_of(other.key_of),
+                  eytzinger_storage(std::move(other.eytzinger_storage)), eytzinger_nodes(other.eytzinger_nodes),
+                  index_dirty(other.index_dirty) {
+            other.eytzinger_nodes = nullptr;
+            other.index_dirty = true;
+        }
+
+        FlatTable& operator=(const FlatTable& other) {
+            if (this == &other) {
+                return *this;
+            }
+            items = other.items;
+            compare = other.compare;
+            key_of = other.key_of;
+            index_dirty = true;
+            if (!other.index_dirty) {
+                buildIndex();
+            }
+            return *this;
+        }
+
+        bool isEmpty() const {
+            return items.isEmpty();
+        }
+
+        size_type getSize() const {
+            return items.getSize();
+        }
+
+        //pierwszy element nie mniejszy niz key
+        const_iterator lower_bound(const Key& key) const {
+            return items.cbegin() + lowerBoundIndex(key);
+        }
+
+        //pierwszy element wiekszy niz key
+        const_iterator upper_bound(const Key& key) const {
+            return items.cbegin() + search([this, &key](const Key& other) { return !compare(key, other); });
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+            size_type first = lowerBoundIndex(key);
+            size_type last = first < items.getSize() && !compare(key, keyAt(first)) ? first + 1 : first;
+            return std::make_pair(items.cbegin() + first, items.cbegin() + last);
+        }
+
+        const_iterator find(const Key& key) const {
+            size_type index = findIndex(key);
+            return index == items.getSize() ? items.cend() : items.cbegin() + index;
+        }
+
+        bool contains(const Key& key) const {
+            return findIndex(key) != items.getSize();
+        }
+
+        //O(n) - przesuwa elementy za miejscem wstawienia; element o istniejacym kluczu nie jest wstawiany
+        std::pair<const_iterator, bool> insert(const Element& item) {
+            size_type index = sortedLowerBound(key_of(item));
+            if (index < items.getSize() && !compare(key_of(item), keyAt(index))) {
+                return std::make_pair(items.cbegin() + index, false);
+            }
+            items.insert(items.cbegin() + index, item);
+            index_dirty = true;
+            return std::make_pair(items.cbegin() + index, true);
+        }
+
+        //sortuje paczke, odrzuca klucze juz obecne (takze powtorzone w paczce - wygrywa pierwszy)
+        //i scala ja z wektorem jednym przebiegiem od konca - O(m log m + m log n + n)
+        template <typename InputIt>
+        void insertBatch(InputIt first, InputIt last) {
+            Vector<Element> batch;
+            for (; first != last; ++first) {
+                batch.append(*first);
+            }
+            Element* batch_data = batch.data();
+            std::stable_sort(batch_data, batch_data + batch.getSize(), [this](const Element& a, const Element& b) {
+                return compare(key_of(a), key_of(b));
+            });
+
+            size_type kept = 0;
+            for (size_type j = 0; j < batch.getSize(); ++j) {
+                if (kept > 0 && !compare(key_of(batch_data[kept - 1]), key_of(batch_data[j]))) {
+                    continue;
+                }
+                if (sortedFindIndex(key_of(batch_data[j])) != items.getSize()) {
+                    continue;
+                }
+                if (kept != j) {
+                    batch_data[kept] = std::move(batch_data[j]);
+                }
+                ++kept;
+            }
+            if (kept == 0) {
+                buildIndex();
+                return;
+            }
+
+            difference_type read = static_cast<difference_type>(items.getSize()) - 1;
+            for (size_type j = 0; j < kept; ++j) {
+                items.append(batch_data[j]);
+            }
+            Element* data = items.data();
+            difference_type write = static_cast<difference_type>(items.getSize()) - 1;
+            difference_type next = static_cast<difference_type>(kept) - 1;
+            while (next >= 0) {
+                if (read >= 0 && compare(key_of(batch_data[next]), key_of(data[read]))) {
+                    data[write--] = std::move(data[read--]);
+                }
+                else {
+                    data[write--] = std::move(batch_data[next--]);
+                }
+            }
+            index_dirty = true;
+            buildIndex();
+        }
+
+        void insertBatch(std::initializer_list<Element> l) {
+            insertBatch(l.begin(), l.end());
+        }
+
+        void erase(const const_iterator& position) {
+            if (position == items.cend()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            items.erase(position);
+            index_dirty = true;
+        }
+
+        //zwraca liczbe usunietych elementow (0 lub 1)
+        size_type erase(const Key& key) {
+            size_type index = sortedFindIndex(key);
+            if (index == items.getSize()) {
+                return 0;
+            }
+            items.erase(items.cbegin() + index);
+            index_dirty = true;
+            return 1;
+        }
+
+        //buduje uklad Eytzingera po pojedynczych insert/erase - O(n); dla Sorted nic nie robi
+        void buildIndex() {
+            if (Layout == SearchLayout::Eytzinger && index_dirty) {
+                buildEytzinger();
+            }
+        }
+
+        const_iterator cbegin() const {
+            return items.cbegin();
+        }
+
+        const_iterator cend() const {
+            return items.cend();
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    protected:
+        const Key& keyAt(size_type index) const {
+            return key_of(items.data()[index]);
+        }
+
+        //publiczne wyszukiwania (find, contains, lower_bound, ...) ida przez wybrany uklad
+        size_type lowerBoundIndex(const Key& key) const {
+            return search([this, &key](const Key& other) { return compare(other, key); });
+        }
+
+        //getSize() gdy klucza nie ma
+        size_type findIndex(const Key& key) const {
+            if (Layout == SearchLayout::Eytzinger && !index_dirty) {
+                //porownanie z kluczem z wezla - bez dodatkowego odczytu z wektora
+                const EytzingerNode* node = eytzingerNode([this, &key](const Key& other) { return compare(other, key); });
+                if (node != nullptr && !compare(key, node->key)) {
+                    return node->rank;
+                }
+                return items.getSize();
+            }
+            return sortedFindIndex(key);
+        }
+
+        //modyfikacje szukaja zawsze w posortowanym wektorze - kazda z nich uniewaznia
+        //uklad Eytzingera, wiec korzystanie z niego oznaczaloby przebudowe O(n) przy kazdej zmianie
+        size_type sortedLowerBound(const Key& key) const {
+            return sortedSearch([this, &key](const Key& other) { return compare(other, key); });
+        }
+
+        size_type sortedFindIndex(const Key& key) const {
+            size_type index = sortedLowerBound(key);
+            if (index < items.getSize() && !compare(key, keyAt(index))) {
+                return index;
+            }
+            return items.getSize();
+        }
+
+        //indeks pierwszego elementu, dla ktorego before(klucz) jest falszywe;
+        //before musi byc prawdziwe dla poczatkowego fragmentu wektora
+        template <typename Before>
+        size_type search(Before before) const {
+            if (Layout == SearchLayout::Eytzinger && !index_dirty) {
+                return eytzingerSearch(before);
+            }
+            return sortedSearch(before);
+        }
+
+        template <typename Before>
+        size_type sortedSearch(Before before) const {
+            const Element* first = items.data();
+            const Element* base = first;
+            size_type n = items.getSize();
+            if (n == 0) {
+                return 0;
+            }
+            //warunek wybiera wskaznik, a nie galaz - kompilator zamienia go na cmov
+            while (n > 1) {
+                size_type half = n / 2;
+                base = before(key_of(base[half])) ? base + half : base;
+                n -= half;
+            }
+            return (base - first) + before(key_of(*base));
+        }
+
+        //klucz i jego pozycja w wektorze w jednym wezle - koncowy odczyt pozycji trafia
+        //w wezel, ktorego klucz byl wlasnie porownywany, wiec nie kosztuje chybienia w cache
+        struct EytzingerNode {
+            Key key;
+            std::uint32_t rank;
+        };
+
+        template <typename Before>
+        size_type eytzingerSearch(Before before) const {
+            const EytzingerNode* node = eytzingerNode(before);
+            return node == nullptr ? items.getSize() : node->rank;
+        }
+
+        //wezel pierwszego elementu, dla ktorego before jest falszywe; nullptr gdy takiego nie ma
+        template <typename Before>
+        const EytzingerNode* eytzingerNode(Before before) const {
+            const size_type n = items.getSize();
+            const EytzingerNode* nodes = eytzinger_nodes;
+            size_type k = 1;
+            while (k <= n) {
+                //potomkowie o PREFETCH_LEVELS poziomow nizej leza w jednej linii - pobiera je zawczasu
+                //adres liczony na liczbach - za ostatnim poziomem wskazuje poza tablice, a prefetch nie zglasza bledow
+                __builtin_prefetch(reinterpret_cast<const void*>(
+                        reinterpret_cast<std::uintptr_t>(nodes) + (k << PREFETCH_LEVELS) * sizeof(EytzingerNode)));
+                k = 2 * k + before(nodes[k].key);
+            }
+            //cofa sie o ostatnie skrety w prawo i jeszcze jeden poziom
+            k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+            return k == 0 ? nullptr : nodes + k;
+        }
+
+        void buildEytzinger() {
+            //zapas na wyrownanie: wezly 2^j * k ... leza wtedy w jednej linii cache
+            if (items.getSize() > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::length_error("Eytzinger layout supports up to 2^32 - 1 elements");
+            }
+            const size_type padding = CACHE_LINE / sizeof(EytzingerNode) + 1;
+            eytzinger_storage.assign(items.getSize() + 1 + padding, EytzingerNode());
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(eytzinger_storage.data());
+            std::uintptr_t aligned = (address + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+            eytzinger_nodes = eytzinger_storage.data() + (aligned - address) / sizeof(EytzingerNode);
+            fillEytzinger(0, 1);
+            index_dirty = false;
+        }
+
+        //przejscie in-order po kopcu przypisuje kolejne elementy wektora
+        size_type fillEytzinger(size_type index, size_type k) {
+            if (k <= items.getSize()) {
+                index = fillEytzinger(index, 2 * k);
+                eytzinger_nodes[k].key = keyAt(index);
+                eytzinger_nodes[k].rank = index;
+                index = fillEytzinger(index + 1, 2 * k + 1);
+            }
+            return index;
+        }
+
+        static const std::size_t CACHE_LINE = 64;
+        static const unsigned PREFETCH_LEVELS = sizeof(EytzingerNode) <= 8 ? 3
+                                                : sizeof(EytzingerNode) <= 16 ? 2
+                                                : sizeof(EytzingerNode) <= 32 ? 1 : 0;
+
+        Vector<Element> items;
+        Compare compare;
+        KeyOf key_of;
+
+        //uklad Eytzingera - wazny tylko gdy !index_dirty
+        std::vector<EytzingerNode> eytzinger_storage;
+        EytzingerNode* eytzinger_nodes;
+        bool index_dirty;
+    };
+
+    struct SetKeyOf {
+        template <typename Key>
+        const Key& operator()(const Key& key) const {
+            return key;
+        }
+    };
+
+    struct MapKeyOf {
+        template <typename Key, typename Value>
+        const Key& operator()(const std::pair<Key, Value>& item) const {
+            return item.first;
+        }
+    };
+
+    template <typename Key, typename Compare = std::less<Key>, SearchLayout Layout = SearchLayout::Sorted>
+    class FlatSet : public FlatTable<Key, Key, SetKeyOf, Compare, Layout> {
+        using Base = FlatTable<Key, Key, SetKeyOf, Compare, Layout>;
+    public:
+        FlatSet() {}
+
+        explicit FlatSet(const Compare& compare) : Base(compare) {}
+
+        FlatSet(std::initializer_list<Key> l) {
+            Base::insertBatch(l.begin(), l.end());
+        }
+    };
+
+    //iteracja daje pary (klucz, wartosc) tylko do odczytu, wartosci zmienia sie przez operator[] / at()
+    template <typename Key, typename Value, typename Compare = std::less<Key>, SearchLayout Layout = SearchLayout::Sorted>
+    class FlatMap : public FlatTable<std::pair<Key, Value>, Key, MapKeyOf, Compare, Layout> {
+        using Base = FlatTable<std::pair<Key, Value>, Key, MapKeyOf, Compare, Layout>;
+    public:
+        using mapped_type = Value;
+        using size_type = typename Base::size_type;
+
+        FlatMap() {}
+
+        explicit FlatMap(const Compare& compare) : Base(compare) {}
+
+        FlatMap(std::initializer_list<std::pair<Key, Value>> l) {
+            Base::insertBatch(l.begin(), l.end());
+        }
+
+        using Base::insert;
+
+        std::pair<typename Base::const_iterator, bool> insert(const Key& key, const Value& value) {
+            return Base::insert(std::make_pair(key, value));
+        }
+
+        //wstawia wartosc domyslna, gdy klucza nie ma
+        Value& operator[](const Key& key) {
+            size_type index = Base::sortedLowerBound(key);
+            if (index == this->items.getSize() || this->compare(key, Base::keyAt(index))) {
+                this->items.insert(this->items.cbegin() + index, std::make_pair(key, Value()));
+                this->index_dirty = true;
+            }
+            return this->items.data()[index].second;
+        }
+
+        Value& at(const Key& key) {
+            size_type index = Base::findIndex(key);
+            if (index == this->items.getSize()) {
+                throw std::out_of_range("Key not found");
+            }
+            return this->items.data()[index].second;
+        }
+
+        const Value& at(const Key& key) const {
+            size_type index = Base::findIndex(key);
+            if (index == this->items.getSize()) {
+                throw std::out_of_range("Key not found");
+            }
+            return this->items.data()[index].second;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_FLATSET_H
@@ -0,0 +1,435 @@
+#ifndef AISDI_LINEAR_SLOTMAP_H
+#define AISDI_LINEAR_SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aisdi {
+
+    //kontener z uchwytami: elementy leza w blokach stalej wielkosci i nigdy nie sa przesuwane,
+    //wiec referencje i iteratory pozostaja wazne az do usuniecia wskazywanego elementu
+    //
+    //skip[i] - pole przeskokow: dla ciagu usunietych slotow pierwszy i ostatni slot ciagu
+    //przechowuja jego dlugosc, zajete sloty maja 0; iteracja przeskakuje ciag jednym dodawaniem
+    //generation[i] - nieparzysta gdy slot jest zajety, uchwyt z inna generacja jest niewazny
+    template <typename Type, std::size_t BlockSize = 256>
+    class SlotMap {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        using index_type = std::uint32_t;
+
+        struct Handle {
+            index_type index;
+            index_type generation;
+
+            bool operator==(const Handle& other) const {
+                return index == other.index && generation == other.generation;
+            }
+
+            bool operator!=(const Handle& other) const {
+                return !(*this == other);
+            }
+        };
+
+        class ConstIterator;
+        class Iterator;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        SlotMap() : size(0), slot_count(0), free_head(NONE), skip(1, 0) {}
+
+        SlotMap(std::initializer_list<Type> l) : SlotMap() {
+            for (const auto& val : l) {
+                insert(val);
+            }
+        }
+
+        //kopia zachowuje uklad slotow, wiec uchwyty z oryginalu sa wazne takze w kopii
+        SlotMap(const SlotMap& other)
+                : size(0), slot_count(0), free_head(other.free_head), generation(other.generation),
+                  skip(other.skip), run_next(other.run_next), run_prev(other.run_prev) {
+            try {
+                while (slot_count < other.slot_count) {
+                    if (slot_count % BlockSize == 0) {
+                        blocks.push_back(new Block);
+                    }
+                    if (isAlive(slot_count)) {
+                        new (slotPointer(slot_count)) Type(*other.slotPointer(slot_count));
+                        ++size;
+                    }
+                    ++slot_count;
+                }
+            }
+            catch (...) {
+                clearSlots();
+                throw;
+            }
+        }
+
+        SlotMap(SlotMap&& other) : SlotMap() {
+            swap(other);
+        }
+
+        ~SlotMap() {
+            clearSlots();
+        }
+
+        SlotMap& operator=(const SlotMap& other) {
+            if (this == &other) {
+                return *this;
+            }
+            SlotMap copy(other);
+            swap(copy);
+            return *this;
+        }
+
+        SlotMap& operator=(SlotMap&& other) {
+            if (this == &other) {
+                return *this;
+            }
+            SlotMap emptied;
+            swap(emptied);
+            swap(other);
+            return *this;
+        }
+
+        bool isEmpty() const {
+            return size == 0;
+        }
+
+        size_type getSize() const {
+            return size;
+        }
+
+        //zajmuje poczatek pierwszego ciagu wolnych slotow albo nowy slot na koncu - O(1)
+        Handle insert(const Type& item) {
+            if (free_head == NONE) {
+                return insertBack(item);
+            }
+            index_type slot = free_head;
+            new (slotPointer(slot)) Type(item);
+            index_type length = skip[slot];
+            unlinkRun(slot);
+            if (length > 1) {
+                skip[slot + 1] = length - 1;
+                skip[slot + length - 1] = length - 1;
+                linkRun(slot + 1);
+            }
+            skip[slot] = 0;
+            ++generation[slot];
+            ++size;
+            return Handle{slot, generation[slot]};
+        }
+
+        void erase(const Handle& handle) {
+            if (!contains(handle)) {
+                throw std::out_of_range("Invalid handle");
+            }
+            eraseSlot(handle.index);
+        }
+
+        void erase(const const_iterator& position) {
+            if (position == end()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            eraseSlot(position.index);
+        }
+
+        bool contains(const Handle& handle) const {
+            return handle.index < slot_count && generation[handle.index] == handle.generation;
+        }
+
+        //nullptr gdy uchwyt jest niewazny
+        pointer find(const Handle& handle) {
+            return contains(handle) ? slotPointer(handle.index) : nullptr;
+        }
+
+        const_pointer find(const Handle& handle) const {
+            return contains(handle) ? slotPointer(handle.index) : nullptr;
+        }
+
+        reference operator[](const Handle& handle) {
+            if (!contains(handle)) {
+                throw std::out_of_range("Invalid handle");
+            }
+            return *slotPointer(handle.index);
+        }
+
+        const_reference operator[](const Handle& handle) const {
+            if (!contains(handle)) {
+                throw std::out_of_range("Invalid handle");
+            }
+            return *slotPointer(handle.index);
+        }
+
+        iterator begin() {
+            return iterator(skip[0], *this);
+        }
+
+        iterator end() {
+            return iterator(slot_count, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(skip[0], *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(slot_count, *this);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        struct Block {
+            typename std::aligned_storage<sizeof(Type), alignof(Type)>::type slots[BlockSize];
+        };
+
+        static const index_type NONE = std::numeric_limits<index_type>::max();
+
+        pointer slotPointer(index_type slot) const {
+            return reinterpret_cast<pointer>(&blocks[slot / BlockSize]->slots[slot % BlockSize]);
+        }
+
+        bool isAlive(index_type slot) const {
+            return generation[slot] % 2 == 1;
+        }
+
+        Handle insertBack(const Type& item) {
+            if (slot_count == NONE - 1) {
+                throw std::length_error("SlotMap is full");
+            }
+            index_type slot = slot_count;
+            if (slot % BlockSize == 0 && slot / BlockSize == blocks.size()) {
+                blocks.push_back(new Block);
+            }
+            //stary wartownik staje sie zajetym slotem, dochodzi nowy wartownik
+            try {
+                skip.push_back(0);
+                generation.push_back(0);
+                run_next.push_back(NONE);
+                run_prev.push_back(NONE);
+                new (slotPointer(slot)) Type(item);
+            }
+            catch (...) {
+                skip.resize(slot + 1);
+                generation.resize(slot);
+                run_next.resize(slot);
+                run_prev.resize(slot);
+                throw;
+            }
+            generation[slot] = 1;
+            ++slot_count;
+            ++size;
+            return Handle{slot, 1};
+        }
+
+        //laczy usuwany slot z sasiednimi ciagami wolnych slotow - O(1)
+        void eraseSlot(index_type slot) {
+            slotPointer(slot)->~Type();
+            ++generation[slot];
+            index_type left = slot > 0 ? skip[slot - 1] : 0;
+            index_type right = skip[slot + 1];
+            if (right > 0) {
+                unlinkRun(slot + 1);
+            }
+            index_type start = slot - left;
+            if (left == 0) {
+                linkRun(slot);
+            }
+            index_type length = left + right + 1;
+            skip[start] = length;
+            skip[start + length - 1] = length;
+            --size;
+        }
+
+        void linkRun(index_type start) {
+            run_prev[start] = NONE;
+            run_next[start] = free_head;
+            if (free_head != NONE) {
+                run_prev[free_head] = start;
+            }
+            free_head = start;
+        }
+
+        void unlinkRun(index_type start) {
+            if (run_prev[start] != NONE) {
+                run_next[run_prev[start]] = run_next[start];
+            }
+            else {
+                free_head = run_next[start];
+            }
+            if (run_next[start] != NONE) {
+                run_prev[run_next[start]] = run_prev[start];
+            }
+        }
+
+        void clearSlots() {
+            for (index_type slot = 0; slot < slot_count; ++slot) {
+                if (isAlive(slot)) {
+                    slotPointer(slot)->~Type();
+                }
+            }
+            for (Block* block : blocks) {
+                delete block;
+            }
+            blocks.clear();
+            slot_count = 0;
+            size = 0;
+        }
+
+        void swap(SlotMap& other) {
+            std::swap(size, other.size);
+            std::swap(slot_count, other.slot_count);
+            std::swap(free_head, other.free_head);
+            blocks.swap(other.blocks);
+            generation.swap(other.generation);
+            skip.swap(other.skip);
+            run_next.swap(other.run_next);
+            run_prev.swap(other.run_prev);
+        }
+
+        size_type size;
+        index_type slot_count;
+        index_type free_head;
+        std::vector<Block*> blocks;
+        std::vector<index_type> generation;
+        std::vector<index_type> skip;
+        std::vector<index_type> run_next;
+        std::vector<index_type> run_prev;
+    };
+
+    template <typename Type, std::size_t BlockSize>
+    const typename SlotMap<Type, BlockSize>::index_type SlotMap<Type, BlockSize>::NONE;
+
+    template <typename Type, std::size_t BlockSize>
+    class SlotMap<Type, BlockSize>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename SlotMap::value_type;
+        using difference_type = typename SlotMap::difference_type;
+        using pointer = typename SlotMap::const_pointer;
+        using reference = typename SlotMap::const_reference;
+
+        explicit ConstIterator(index_type index, const SlotMap& parent) : index(index), parent(&parent) {}
+
+        reference operator*() const {
+            if (index >= parent->slot_count) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            return *parent->slotPointer(index);
+        }
+
+        Handle handle() const {
+            if (index >= parent->slot_count) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            return Handle{index, parent->generation[index]};
+        }
+
+        ConstIterator& operator++() {
+            if (index >= parent->slot_count) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            ++index;
+            index += parent->skip[index];
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        ConstIterator& operator--() {
+            if (*this == parent->begin()) {
+                throw std::out_of_range("Iterator out of range");
+            }
+            --index;
+            index -= parent->skip[index];
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator result = *this;
+            --(*this);
+            return result;
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return index == other.index;
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        friend class SlotMap;
+
+        index_type index;
+        const SlotMap* parent;
+    };
+
+    template <typename Type, std::size_t BlockSize>
+    class SlotMap<Type, BlockSize>::Iterator : public SlotMap<Type, BlockSize>::ConstIterator {
+    public:
+        using pointer = typename SlotMap::pointer;
+        using reference = typename SlotMap::reference;
+
+        explicit Iterator(index_type index, SlotMap& parent) : ConstIterator(index, parent) {}
+
+        Iterator(const ConstIterator& other)
+                : ConstIterator(other) {}
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        reference operator*() const {
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_SLOTMAP_H
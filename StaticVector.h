@@ -0,0 +1,491 @@
+#ifndef AISDI_LINEAR_STATICVECTOR_H
+#define AISDI_LINEAR_STATICVECTOR_H
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi {
+
+    //polityki bledow StaticVector - przez nie przechodza wszystkie bledy kontenera i jego iteratorow:
+    //overflow() - do pelnego wektora dochodzi element
+    //empty() - pop z pustego wektora
+    //outOfRange() - erase(end()), dereferencja lub przesuniecie iteratora poza zakres
+    //jezeli hook wroci (AssertOnOverflow z NDEBUG), operacja nic nie zmienia: pop zwraca Type(),
+    //iterator stoi w miejscu, a dereferencja daje pierwszy slot bufora (dla typow nietrywialnych
+    //moze byc nieskonstruowany - wartosci nie wolno uzywac)
+    //w wyrazeniu constexpr kazdy z tych bledow konczy sie bledem kompilacji
+    struct ThrowOnOverflow {
+        static void overflow() {
+            throw std::length_error("StaticVector is full");
+        }
+
+        static void empty() {
+            throw std::logic_error("Empty collection");
+        }
+
+        static void outOfRange() {
+            throw std::out_of_range("Iterator out of range");
+        }
+    };
+
+    //zaden blad nie rzuca wyjatku, wiec StaticVector z ta polityka nigdy nie alokuje
+    struct AssertOnOverflow {
+        static void overflow() {
+            assert(!"StaticVector is full");
+        }
+
+        static void empty() {
+            assert(!"Empty collection");
+        }
+
+        static void outOfRange() {
+            assert(!"Iterator out of range");
+        }
+    };
+
+    //bufor StaticVector razem z rozmiarem
+    //typy trywialne: zwykla tablica - w C++14 konstruktor constexpr musi ja zainicjowac, wiec kazda
+    //konstrukcja zeruje caly bufor (jeden memset, O(Capacity)); usuniete elementy nie trzymaja zasobow
+    //pozostale typy: surowa pamiec, element powstaje przez placement new i jest niszczony przy usuwaniu
+    template <typename Type, std::size_t Capacity, bool Trivial = std::is_trivial<Type>::value>
+    class StaticVectorStorage {
+    protected:
+        constexpr StaticVectorStorage() : items{}, current_size(0) {}
+
+        constexpr Type* slots() {
+            return items;
+        }
+
+        constexpr const Type* slots() const {
+            return items;
+        }
+
+        constexpr void construct(std::size_t index, const Type& item) {
+            items[index] = item;
+        }
+
+        constexpr void destroy(std::size_t) {}
+
+        Type items[Capacity];
+        std::size_t current_size;
+    };
+
+    template <typename Type, std::size_t Capacity>
+    class StaticVectorStorage<Type, Capacity, false> {
+    protected:
+        StaticVectorStorage() : current_size(0) {}
+
+        StaticVectorStorage(const StaticVectorStorage& other) : current_size(0) {
+            copyFrom(other);
+        }
+
+        StaticVectorStorage(StaticVectorStorage&& other) : current_size(0) {
+            moveFrom(other);
+        }
+
+        ~StaticVectorStorage() {
+            clear();
+        }
+
+        StaticVectorStorage& operator=(const StaticVectorStorage& other) {
+            if (this != &other) {
+                clear();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        StaticVectorStorage& operator=(StaticVectorStorage&& other) {
+            if (this != &other) {
+                clear();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        Type* slots() {
+            return reinterpret_cast<Type*>(items);
+        }
+
+        const Type* slots() const {
+            return reinterpret_cast<const Type*>(items);
+        }
+
+        void construct(std::size_t index, const Type& item) {
+            new (slots() + index) Type(item);
+        }
+
+        void construct(std::size_t index, Type&& item) {
+            new (slots() + index) Type(std::move(item));
+        }
+
+        void destroy(std::size_t index) {
+            slots()[index].~Type();
+        }
+
+        typename std::aligned_storage<sizeof(Type), alignof(Type)>::type items[Capacity];
+        std::size_t current_size;
+
+    private:
+        void clear() {
+            while (current_size > 0) {
+                destroy(--current_size);
+            }
+        }
+
+        void copyFrom(const StaticVectorStorage& other) {
+            try {
+                for (; current_size < other.current_size; ++current_size) {
+                    construct(current_size, other.slots()[current_size]);
+                }
+            }
+            catch (...) {
+                clear();
+                throw;
+            }
+        }
+
+        void moveFrom(StaticVectorStorage& other) {
+            try {
+                for (; current_size < other.current_size; ++current_size) {
+                    construct(current_size, std::move(other.slots()[current_size]));
+                }
+            }
+            catch (...) {
+                clear();
+                throw;
+            }
+        }
+    };
+
+    //wektor o stalej pojemnosci z buforem wewnatrz obiektu - nigdy nie alokuje
+    //dla typow literalnych wszystkie operacje sa constexpr (np. tablice budowane w czasie kompilacji)
+    template <typename Type, std::size_t Capacity, typename Overflow = ThrowOnOverflow>
+    class StaticVector : private StaticVectorStorage<Type, Capacity> {
+        using Storage = StaticVectorStorage<Type, Capacity>;
+        using Storage::current_size;
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        static_assert(Capacity > 0, "StaticVector capacity must be positive");
+
+        class ConstIterator;
+        class Iterator;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        constexpr StaticVector() {}
+
+        constexpr StaticVector(std::initializer_list<Type> l) {
+            for (const auto& val : l) {
+                append(val);
+            }
+        }
+
+        constexpr bool isEmpty() const {
+            return current_size == 0;
+        }
+
+        constexpr bool isFull() const {
+            return current_size == Capacity;
+        }
+
+        constexpr size_type getSize() const {
+            return current_size;
+        }
+
+        static constexpr size_type getCapacity() {
+            return Capacity;
+        }
+
+        constexpr void append(const Type& item) {
+            insert(end(), item);
+        }
+
+        constexpr void prepend(const Type& item) {
+            insert(begin(), item);
+        }
+
+        //przesuwa elementy o jeden od podanego iteratora i wstawia w wolne miejsce
+        constexpr void insert(const const_iterator& insertPosition, const Type& item) {
+            if (!tryInsert(insertPosition, item)) {
+                Overflow::overflow();
+            }
+        }
+
+        //false zamiast polityki przepelnienia
+        constexpr bool tryAppend(const Type& item) {
+            return tryInsert(end(), item);
+        }
+
+        constexpr bool tryPrepend(const Type& item) {
+            return tryInsert(begin(), item);
+        }
+
+        constexpr bool tryInsert(const const_iterator& insertPosition, const Type& item) {
+            if (isFull()) {
+                return false;
+            }
+            size_type distance = insertPosition - cbegin();
+            if (distance == current_size) {
+                Storage::construct(current_size, item);
+            }
+            else {
+                //item moze byc elementem tego wektora - kopia zanim przesuniecie go nadpisze
+                Type value = item;
+                Type* items = data();
+                Storage::construct(current_size, std::move(items[current_size - 1]));
+                for (size_type i = current_size - 1; i > distance; --i) {
+                    items[i] = std::move(items[i - 1]);
+                }
+                items[distance] = std::move(value);
+            }
+            ++current_size;
+            return true;
+        }
+
+        constexpr Type popFirst() {
+            if (isEmpty()) {
+                Overflow::empty();
+                return Type();
+            }
+            Type* items = data();
+            Type val = std::move(items[0]);
+            for (size_type i = 1; i < current_size; ++i) {
+                items[i - 1] = std::move(items[i]);
+            }
+            --current_size;
+            Storage::destroy(current_size);
+            return val;
+        }
+
+        constexpr Type popLast() {
+            if (isEmpty()) {
+                Overflow::empty();
+                return Type();
+            }
+            --current_size;
+            Type val = std::move(data()[current_size]);
+            Storage::destroy(current_size);
+            return val;
+        }
+
+        constexpr void erase(const const_iterator& position) {
+            if (position == cend()) {
+                Overflow::outOfRange();
+                return;
+            }
+            erase(position, position + 1);
+        }
+
+        constexpr void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            size_type first = firstIncluded - cbegin();
+            size_type last = lastExcluded - cbegin();
+            Type* items = data();
+            for (size_type i = last; i < current_size; ++i) {
+                items[first + i - last] = std::move(items[i]);
+            }
+            for (size_type i = current_size - (last - first); i < current_size; ++i) {
+                Storage::destroy(i);
+            }
+            current_size -= last - first;
+        }
+
+        constexpr pointer data() {
+            return Storage::slots();
+        }
+
+        constexpr const_pointer data() const {
+            return Storage::slots();
+        }
+
+        constexpr iterator begin() {
+            return iterator(data(), *this);
+        }
+
+        constexpr iterator end() {
+            return iterator(data() + current_size, *this);
+        }
+
+        constexpr const_iterator cbegin() const {
+            return const_iterator(data(), *this);
+        }
+
+        constexpr const_iterator cend() const {
+            return const_iterator(data() + current_size, *this);
+        }
+
+        constexpr const_iterator begin() const {
+            return cbegin();
+        }
+
+        constexpr const_iterator end() const {
+            return cend();
+        }
+    };
+
+    template <typename Type, std::size_t Capacity, typename Overflow>
+    class StaticVector<Type, Capacity, Overflow>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename StaticVector::value_type;
+        using difference_type = typename StaticVector::difference_type;
+        using pointer = typename StaticVector::const_pointer;
+        using reference = typename StaticVector::const_reference;
+
+        constexpr explicit ConstIterator(pointer ptr, const StaticVector& parent) : current_pointer(ptr), parent(&parent) {}
+
+        constexpr reference operator*() const {
+            if (*this < parent->begin() || *this >= parent->end()) {
+                Overflow::outOfRange();
+                return *parent->data();
+            }
+            return *current_pointer;
+        }
+
+        constexpr ConstIterator& operator++() {
+            if (*this >= parent->end()) {
+                Overflow::outOfRange();
+                return *this;
+            }
+            ++current_pointer;
+            return *this;
+        }
+
+        constexpr ConstIterator operator++(int) {
+            ConstIterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        constexpr ConstIterator& operator--() {
+            if (*this <= parent->begin()) {
+                Overflow::outOfRange();
+                return *this;
+            }
+            --current_pointer;
+            return *this;
+        }
+
+        constexpr ConstIterator operator--(int) {
+            ConstIterator result = *this;
+            --(*this);
+            return result;
+        }
+
+        constexpr ConstIterator& operator+=(difference_type d) {
+            current_pointer += d;
+            return *this;
+        }
+
+        constexpr ConstIterator& operator-=(difference_type d) {
+            current_pointer -= d;
+            return *this;
+        }
+
+        constexpr ConstIterator operator+(difference_type d) const {
+            ConstIterator new_iter = *this;
+            new_iter += d;
+            return new_iter;
+        }
+
+        constexpr difference_type operator-(const ConstIterator& other) const {
+            return current_pointer - other.current_pointer;
+        }
+
+        constexpr ConstIterator operator-(difference_type d) const {
+            ConstIterator new_iter = *this;
+            new_iter -= d;
+            return new_iter;
+        }
+
+        constexpr bool operator==(const ConstIterator& other) const {
+            return current_pointer == other.current_pointer;
+        }
+
+        constexpr bool operator!=(const ConstIterator& other) const {
+            return !(*this == other);
+        }
+
+        constexpr bool operator<=(const ConstIterator& other) const {
+            return current_pointer <= other.current_pointer;
+        }
+
+        constexpr bool operator>=(const ConstIterator& other) const {
+            return current_pointer >= other.current_pointer;
+        }
+
+        constexpr bool operator<(const ConstIterator& other) const {
+            return !(*this >= other);
+        }
+
+        constexpr bool operator>(const ConstIterator& other) const {
+            return !(*this <= other);
+        }
+
+    protected:
+        pointer current_pointer;
+        const StaticVector* parent;
+    };
+
+    template <typename Type, std::size_t Capacity, typename Overflow>
+    class StaticVector<Type, Capacity, Overflow>::Iterator : public StaticVector<Type, Capacity, Overflow>::ConstIterator {
+    public:
+        using pointer = typename StaticVector::pointer;
+        using reference = typename StaticVector::reference;
+
+        constexpr explicit Iterator(pointer ptr, StaticVector& parent) : ConstIterator(ptr, parent) {}
+
+        constexpr Iterator(const ConstIterator& other)
+                : ConstIterator(other) {}
+
+        constexpr Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        constexpr Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        constexpr Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        constexpr Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        constexpr Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        constexpr reference operator*() const {
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_STATICVECTOR_H
@@ -0,0 +1,180 @@
+#ifndef AISDI_LINEAR_STORAGE_H
+#define AISDI_LINEAR_STORAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <algorithm>
+#include <type_traits>
+
+#include <sys/mman.h>
+
+namespace aisdi {
+
+    //polityka pamieci dla Vector (por. HeapStorage w Vector.h) oparta o POSIX/Linux -
+    //naglowek dolaczamy tylko tam, gdzie AlignedStorage jest uzywany
+
+    enum class HugePages {
+        None,
+        Transparent, //madvise(MADV_HUGEPAGE)
+        Explicit     //MAP_HUGETLB, a gdy sie nie uda - jak Transparent
+    };
+
+    //male bufory: posix_memalign z zadanym wyrownaniem
+    //duze bufory (od MMAP_THRESHOLD bajtow): mmap zaokraglony do duzej strony, rosnie przez mremap
+    template <typename Type, std::size_t Alignment = 64, HugePages Pages = HugePages::Transparent>
+    struct AlignedStorage {
+        static_assert(Alignment >= alignof(Type) && (Alignment & (Alignment - 1)) == 0,
+                      "Alignment must be a power of two not smaller than alignof(Type)");
+        static_assert(Alignment <= 4096, "Alignment larger than a page is not supported");
+
+        static const std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+        static const std::size_t MMAP_THRESHOLD = HUGE_PAGE_SIZE;
+
+        static Type* allocate(std::size_t n) {
+            Type* ptr = static_cast<Type*>(allocateRaw(n * sizeof(Type)));
+            construct(ptr, 0, n);
+            return ptr;
+        }
+
+        static void deallocate(Type* ptr, std::size_t n) {
+            if (ptr == nullptr) {
+                return;
+            }
+            destroy(ptr, 0, n);
+            deallocateRaw(ptr, n * sizeof(Type));
+        }
+
+        static Type* reallocate(Type* ptr, std::size_t used, std::size_t old_size, std::size_t new_size) {
+            std::size_t old_bytes = old_size * sizeof(Type);
+            std::size_t new_bytes = new_size * sizeof(Type);
+            if (std::is_trivially_copyable<Type>::value && isMapped(old_bytes)) {
+                void* new_ptr = remapAligned(ptr, mappedSize(old_bytes), mappedSize(new_bytes));
+                if (new_ptr != MAP_FAILED) {
+                    Type* result = static_cast<Type*>(new_ptr);
+                    advise(result, mappedSize(new_bytes));
+                    construct(result, old_size, new_size);
+                    return result;
+                }
+            }
+            Type* new_ptr = allocate(new_size);
+            std::copy(ptr, ptr + used, new_ptr);
+            deallocate(ptr, old_size);
+            return new_ptr;
+        }
+
+    private:
+        static bool isMapped(std::size_t bytes) {
+            return bytes >= MMAP_THRESHOLD;
+        }
+
+        static std::size_t mappedSize(std::size_t bytes) {
+            return (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        }
+
+        static void advise(void* ptr, std::size_t bytes) {
+#ifdef MADV_HUGEPAGE
+            if (Pages != HugePages::None) {
+                madvise(ptr, bytes, MADV_HUGEPAGE); //tylko podpowiedz, blad nie jest krytyczny
+            }
+#else
+            (void)ptr;
+            (void)bytes;
+#endif
+        }
+
+        static void* allocateRaw(std::size_t bytes) {
+            if (!isMapped(bytes)) {
+                void* ptr = nullptr;
+                if (posix_memalign(&ptr, Alignment, std::max<std::size_t>(bytes, 1)) != 0) {
+                    throw std::bad_alloc();
+                }
+                return ptr;
+            }
+            std::size_t length = mappedSize(bytes);
+            void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+            if (Pages == HugePages::Explicit) {
+                ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            }
+#endif
+            if (ptr == MAP_FAILED) {
+                ptr = mapAligned(length);
+                if (ptr == MAP_FAILED) {
+                    throw std::bad_alloc();
+                }
+                advise(ptr, length);
+            }
+            return ptr;
+        }
+
+        //jadro nie musi wyrownywac duzych mapowan do 2 MiB, a madvise nie obejmie duzymi stronami
+        //niepelnych fragmentow na brzegach - mapuje o jedna duza strone wiecej i obcina nadmiar
+        static void* mapAligned(std::size_t length) {
+            void* raw = mmap(nullptr, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) {
+                return MAP_FAILED;
+            }
+            std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(raw);
+            std::uintptr_t aligned = (begin + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+            if (aligned > begin) {
+                munmap(raw, aligned - begin);
+            }
+            std::size_t tail = begin + HUGE_PAGE_SIZE - aligned;
+            if (tail > 0) {
+                munmap(reinterpret_cast<void*>(aligned + length), tail);
+            }
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        //najpierw powiekszenie w miejscu (adres, a wiec i wyrownanie, sie nie zmienia),
+        //potem przeniesienie stron do swiezo zarezerwowanego, wyrownanego obszaru (MREMAP_FIXED)
+        static void* remapAligned(void* ptr, std::size_t old_length, std::size_t new_length) {
+            void* result = mremap(ptr, old_length, new_length, 0);
+            if (result != MAP_FAILED) {
+                return result;
+            }
+            void* target = mapAligned(new_length);
+            if (target == MAP_FAILED) {
+                return MAP_FAILED;
+            }
+            result = mremap(ptr, old_length, new_length, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+            if (result == MAP_FAILED) {
+                munmap(target, new_length);
+            }
+            return result;
+        }
+
+        static void deallocateRaw(void* ptr, std::size_t bytes) {
+            if (isMapped(bytes)) {
+                munmap(ptr, mappedSize(bytes));
+            }
+            else {
+                std::free(ptr);
+            }
+        }
+
+        static void construct(Type* ptr, std::size_t from, std::size_t to) {
+            if (std::is_trivially_default_constructible<Type>::value) {
+                return;
+            }
+            for (std::size_t i = from; i < to; ++i) {
+                new (ptr + i) Type;
+            }
+        }
+
+        static void destroy(Type* ptr, std::size_t from, std::size_t to) {
+            if (std::is_trivially_destructible<Type>::value) {
+                return;
+            }
+            for (std::size_t i = from; i < to; ++i) {
+                ptr[i].~Type();
+            }
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_STORAGE_H
@@ -8,7 +8,29 @@
 
 namespace aisdi {
 
+    //polityka pamieci dla Vector: allocate zwraca bufor n skonstruowanych elementow,
+    //deallocate go niszczy, reallocate powieksza bufor zachowujac pierwsze used elementow
+    //inne polityki (np. AlignedStorage z Storage.h) maja ten sam interfejs
     template <typename Type>
+    struct HeapStorage {
+        static Type* allocate(std::size_t n) {
+            return new Type[n];
+        }
+
+        static void deallocate(Type* ptr, std::size_t) {
+            delete[] ptr;
+        }
+
+        static Type* reallocate(Type* ptr, std::size_t used, std::size_t old_size, std::size_t new_size) {
+            Type* new_ptr = allocate(new_size);
+            std::copy(ptr, ptr + used, new_ptr);
+            deallocate(ptr, old_size);
+            return new_ptr;
+        }
+    };
+
+    //Storage decyduje skad pochodzi bufor (np. AlignedStorage dla duzych wektorow)
+    template <typename Type, typename Storage = HeapStorage<Type>>
     class Vector {
     public:
         using difference_type = std::ptrdiff_t;
@@ -25,20 +47,20 @@ namespace aisdi {
         using const_iterator = ConstIterator;
 
         Vector() {
-            array_begin = new Type[FIRST_SIZE];
+            array_begin = Storage::allocate(FIRST_SIZE);
             alloc_size = FIRST_SIZE;
             current_size = 0;
         }
 
         Vector(std::initializer_list<Type> l) {
             current_size = alloc_size = l.size();
-            array_begin = new Type[alloc_size];
+            array_begin = Storage::allocate(alloc_size);
             std::copy(l.begin(), l.end(), array_begin);
         }
 
         Vector(const Vector& other) {
             current_size = alloc_size = other.getSize();
-            array_begin = new Type[alloc_size];
+            array_begin = Storage::allocate(alloc_size);
             std::copy(other.begin(), other.end(), array_begin);
         }
 
@@ -50,16 +72,16 @@ namespace aisdi {
         }
 
         ~Vector() {
-            delete[] array_begin;
+            Storage::deallocate(array_begin, alloc_size);
         }
 
         Vector& operator=(const Vector& other) {
             if (this == &other) {
                 return *this;
             }
-            delete[] array_begin;
-            array_begin = new Type[other.alloc_size];
-            std::copy(other.cbegin(), other.cend(), begin());
+            Storage::deallocate(array_begin, alloc_size);
+            array_begin = Storage::allocate(other.alloc_size);
+            std::copy(other.array_begin, other.array_begin + other.current_size, array_begin);
             alloc_size = other.alloc_size;
             current_size = other.current_size;
             return *this;
@@ -69,7 +91,7 @@ namespace aisdi {
             if (this == &other) {
                 return *this;
             }
-            delete[] array_begin;
+            Storage::deallocate(array_begin, alloc_size);
             array_begin = other.array_begin;
             other.array_begin = nullptr;
             alloc_size = other.alloc_size;
@@ -134,6 +156,15 @@ namespace aisdi {
         }
 
 
+        //bezposredni dostep do ciaglego bufora (np. dla std::sort czy wyszukiwania binarnego)
+        pointer data() {
+            return array_begin;
+        }
+
+        const_pointer data() const {
+            return array_begin;
+        }
+
         iterator begin() {
             return iterator(array_begin, *this);
         }
@@ -160,11 +191,9 @@ namespace aisdi {
 
     private:
         void new_allocate() {
-            Type* new_array = new Type[alloc_size * 2];
-            std::copy(begin(), end(), new_array);
-            alloc_size *= 2;
-            delete[] array_begin;
-            array_begin = new_array;
+            size_type new_size = alloc_size > 0 ? alloc_size * 2 : FIRST_SIZE;
+            array_begin = Storage::reallocate(array_begin, current_size, alloc_size, new_size);
+            alloc_size = new_size;
         }
 
         pointer array_begin;
@@ -174,8 +203,8 @@ namespace aisdi {
         size_type FIRST_SIZE = 10;
     };
 
-    template <typename Type>
-    class Vector<Type>::ConstIterator {
+    template <typename Type, typename Storage>
+    class Vector<Type, Storage>::ConstIterator {
     public:
         using iterator_category = std::bidirectional_iterator_tag;
         using value_type = typename Vector::value_type;
@@ -183,7 +212,7 @@ namespace aisdi {
         using pointer = typename Vector::const_pointer;
         using reference = typename Vector::const_reference;
 
-        explicit ConstIterator(pointer ptr, const Vector<Type>& parent) : current_pointer(ptr), parent(parent) {}
+        explicit ConstIterator(pointer ptr, const Vector& parent) : current_pointer(ptr), parent(parent) {}
 
         reference operator*() const {
             if (*this < parent.begin() || *this >= parent.end()) {
@@ -278,16 +307,16 @@ namespace aisdi {
 
     protected:
         pointer current_pointer;
-        const Vector<Type>& parent;
+        const Vector& parent;
     };
 
-    template <typename Type>
-    class Vector<Type>::Iterator : public Vector<Type>::ConstIterator {
+    template <typename Type, typename Storage>
+    class Vector<Type, Storage>::Iterator : public Vector<Type, Storage>::ConstIterator {
     public:
         using pointer = typename Vector::pointer;
         using reference = typename Vector::reference;
 
-        explicit Iterator(pointer ptr, Vector<Type>& parent) : ConstIterator(ptr, parent) {}
+        explicit Iterator(pointer ptr, Vector& parent) : ConstIterator(ptr, parent) {}
 
         Iterator(const ConstIterator& other)
                 : ConstIterator(other) {}
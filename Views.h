@@ -0,0 +1,790 @@
+#ifndef AISDI_LINEAR_VIEWS_H
+#define AISDI_LINEAR_VIEWS_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi {
+
+    //leniwe widoki na kolekcje - nic nie jest kopiowane do momentu wywolania collect<...>()
+    //widok trzyma referencje do kolekcji, wiec kolekcja musi zyc dluzej niz widok
+    //iteratory widoku trzymaja wskaznik na widok, z ktorego powstaly (jak iteratory Vector/LinkedList)
+    //kolekcja z ciaglym buforem (ma data(), np. Vector) - jej elementy musza byc konstruowalne domyslnie i przypisywalne
+    template <typename Collection, typename = void>
+    struct IsContiguous : std::false_type {};
+
+    template <typename Collection>
+    struct IsContiguous<Collection, decltype(void(std::declval<Collection&>().data()))> : std::true_type {};
+
+    template <typename Derived>
+    class ViewBase {
+    public:
+        template <template <typename...> class Collection, typename View = Derived>
+        Collection<typename std::decay<typename View::value_type>::type> collect() const {
+            using element_type = typename std::decay<typename View::value_type>::type;
+            static_assert(!IsContiguous<Collection<element_type>>::value ||
+                          (std::is_default_constructible<element_type>::value &&
+                           std::is_copy_assignable<element_type>::value),
+                          "collect into a contiguous collection (e.g. Vector) needs default-constructible, "
+                          "copy-assignable elements - collect chunk() into LinkedList");
+            Collection<element_type> result;
+            const Derived& self = static_cast<const Derived&>(*this);
+            for (auto it = self.begin(); it != self.end(); ++it) {
+                result.append(*it);
+            }
+            return result;
+        }
+
+        bool isEmpty() const {
+            const Derived& self = static_cast<const Derived&>(*this);
+            return !(self.begin() != self.end());
+        }
+
+        //przechodzi caly widok - O(n)
+        std::size_t getSize() const {
+            const Derived& self = static_cast<const Derived&>(*this);
+            std::size_t result = 0;
+            for (auto it = self.begin(); it != self.end(); ++it) {
+                ++result;
+            }
+            return result;
+        }
+    };
+
+    //kategoria iteratora widoku: kategoria iteratora bazy, najwyzej dwukierunkowa
+    template <typename BaseIterator>
+    using BidirectionalAtMost = typename std::conditional<
+            std::is_base_of<std::bidirectional_iterator_tag,
+                            typename std::iterator_traits<BaseIterator>::iterator_category>::value,
+            std::bidirectional_iterator_tag,
+            typename std::iterator_traits<BaseIterator>::iterator_category>::type;
+
+    template <typename It>
+    class RangeView : public ViewBase<RangeView<It>> {
+    public:
+        using iterator = It;
+        using const_iterator = It;
+        using reference = decltype(*std::declval<It&>());
+        using value_type = typename std::decay<reference>::type;
+
+        RangeView(const It& first, const It& last) : first(first), last(last) {}
+
+        iterator begin() const {
+            return first;
+        }
+
+        iterator end() const {
+            return last;
+        }
+
+    private:
+        It first;
+        It last;
+    };
+
+    template <typename Base, typename Predicate>
+    class FilterView : public ViewBase<FilterView<Base, Predicate>> {
+        using base_iterator = typename Base::iterator;
+    public:
+        using reference = typename Base::reference;
+        using value_type = typename Base::value_type;
+
+        class Iterator {
+        public:
+            using iterator_category = BidirectionalAtMost<base_iterator>;
+            using value_type = typename FilterView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename FilterView::reference;
+
+            Iterator(const base_iterator& it, const FilterView& parent) : current(it), parent(&parent) {
+                skip();
+            }
+
+            reference operator*() const {
+                return *current;
+            }
+
+            Iterator& operator++() {
+                ++current;
+                skip();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                ++(*this);
+                return result;
+            }
+
+            //zaklada, ze przed biezaca pozycja jest element spelniajacy predykat
+            Iterator& operator--() {
+                do {
+                    --current;
+                } while (!parent->predicate(*current));
+                return *this;
+            }
+
+            Iterator operator--(int) {
+                Iterator result = *this;
+                --(*this);
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            void skip() {
+                while (current != parent->last && !parent->predicate(*current)) {
+                    ++current;
+                }
+            }
+
+            base_iterator current;
+            const FilterView* parent;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        FilterView(const Base& base, const Predicate& predicate)
+                : base(base), predicate(predicate), last(this->base.end()) {}
+
+        FilterView(const FilterView& other)
+                : base(other.base), predicate(other.predicate), last(base.end()) {}
+
+        iterator begin() const {
+            return iterator(base.begin(), *this);
+        }
+
+        iterator end() const {
+            return iterator(last, *this);
+        }
+
+    private:
+        Base base;
+        Predicate predicate;
+        base_iterator last;
+    };
+
+    template <typename Base, typename Function>
+    class TransformView : public ViewBase<TransformView<Base, Function>> {
+        using base_iterator = typename Base::iterator;
+    public:
+        using reference = decltype(std::declval<const Function&>()(std::declval<typename Base::reference>()));
+        using value_type = typename std::decay<reference>::type;
+
+        class Iterator {
+        public:
+            using iterator_category = BidirectionalAtMost<base_iterator>;
+            using value_type = typename TransformView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename TransformView::reference;
+
+            Iterator(const base_iterator& it, const TransformView& parent) : current(it), parent(&parent) {}
+
+            reference operator*() const {
+                return parent->function(*current);
+            }
+
+            Iterator& operator++() {
+                ++current;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                ++current;
+                return result;
+            }
+
+            Iterator& operator--() {
+                --current;
+                return *this;
+            }
+
+            Iterator operator--(int) {
+                Iterator result = *this;
+                --current;
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            base_iterator current;
+            const TransformView* parent;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        TransformView(const Base& base, const Function& function) : base(base), function(function) {}
+
+        iterator begin() const {
+            return iterator(base.begin(), *this);
+        }
+
+        iterator end() const {
+            return iterator(base.end(), *this);
+        }
+
+    private:
+        Base base;
+        Function function;
+    };
+
+    //koniec widoku to albo koniec bazy, albo licznik rowny count
+    template <typename Base>
+    class TakeView : public ViewBase<TakeView<Base>> {
+        using base_iterator = typename Base::iterator;
+    public:
+        using reference = typename Base::reference;
+        using value_type = typename Base::value_type;
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename TakeView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename TakeView::reference;
+
+            Iterator(const base_iterator& it, std::size_t remaining, const base_iterator& last)
+                    : current(it), remaining(remaining), last(last) {}
+
+            reference operator*() const {
+                if (isEnd()) {
+                    throw std::out_of_range("Iterator out of range");
+                }
+                return *current;
+            }
+
+            Iterator& operator++() {
+                if (isEnd()) {
+                    throw std::out_of_range("Iterator out of range");
+                }
+                ++current;
+                --remaining;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                ++(*this);
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                if (isEnd() || other.isEnd()) {
+                    return isEnd() == other.isEnd();
+                }
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            bool isEnd() const {
+                return remaining == 0 || current == last;
+            }
+
+            base_iterator current;
+            std::size_t remaining;
+            base_iterator last;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        TakeView(const Base& base, std::size_t count) : base(base), count(count) {}
+
+        iterator begin() const {
+            return iterator(base.begin(), count, base.end());
+        }
+
+        iterator end() const {
+            return iterator(base.end(), 0, base.end());
+        }
+
+    private:
+        Base base;
+        std::size_t count;
+    };
+
+    template <typename Base>
+    class DropView : public ViewBase<DropView<Base>> {
+    public:
+        using iterator = typename Base::iterator;
+        using const_iterator = iterator;
+        using reference = typename Base::reference;
+        using value_type = typename Base::value_type;
+
+        DropView(const Base& base, std::size_t count) : base(base), count(count) {}
+
+        iterator begin() const {
+            iterator it = base.begin();
+            iterator last = base.end();
+            for (std::size_t i = 0; i < count && it != last; ++i) {
+                ++it;
+            }
+            return it;
+        }
+
+        iterator end() const {
+            return base.end();
+        }
+
+    private:
+        Base base;
+        std::size_t count;
+    };
+
+    template <typename Base>
+    class EnumerateView : public ViewBase<EnumerateView<Base>> {
+        using base_iterator = typename Base::iterator;
+    public:
+        using reference = std::pair<std::size_t, typename Base::reference>;
+        using value_type = std::pair<std::size_t, typename Base::value_type>;
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename EnumerateView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename EnumerateView::reference;
+
+            Iterator(const base_iterator& it, std::size_t index) : current(it), index(index) {}
+
+            reference operator*() const {
+                return reference(index, *current);
+            }
+
+            Iterator& operator++() {
+                ++current;
+                ++index;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                ++(*this);
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            base_iterator current;
+            std::size_t index;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        explicit EnumerateView(const Base& base) : base(base) {}
+
+        iterator begin() const {
+            return iterator(base.begin(), 0);
+        }
+
+        iterator end() const {
+            return iterator(base.end(), 0);
+        }
+
+    private:
+        Base base;
+    };
+
+    //konczy sie razem z krotszym z widokow
+    template <typename First, typename Second>
+    class ZipView : public ViewBase<ZipView<First, Second>> {
+        static_assert(std::is_base_of<ViewBase<Second>, Second>::value,
+                      "ZipView stores its arguments by value - zip a view, not a collection");
+
+        using first_iterator = typename First::iterator;
+        using second_iterator = typename Second::iterator;
+    public:
+        using reference = std::pair<typename First::reference, typename Second::reference>;
+        using value_type = std::pair<typename First::value_type, typename Second::value_type>;
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename ZipView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename ZipView::reference;
+
+            Iterator(const first_iterator& first, const second_iterator& second, const ZipView& parent)
+                    : first(first), second(second), parent(&parent) {}
+
+            reference operator*() const {
+                return reference(*first, *second);
+            }
+
+            Iterator& operator++() {
+                ++first;
+                ++second;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                ++(*this);
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                if (isEnd() || other.isEnd()) {
+                    return isEnd() == other.isEnd();
+                }
+                return first == other.first && second == other.second;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            bool isEnd() const {
+                return first == parent->first_last || second == parent->second_last;
+            }
+
+            first_iterator first;
+            second_iterator second;
+            const ZipView* parent;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        ZipView(const First& first, const Second& second)
+                : first(first), second(second), first_last(this->first.end()), second_last(this->second.end()) {}
+
+        ZipView(const ZipView& other)
+                : first(other.first), second(other.second), first_last(first.end()), second_last(second.end()) {}
+
+        iterator begin() const {
+            return iterator(first.begin(), second.begin(), *this);
+        }
+
+        iterator end() const {
+            return iterator(first_last, second_last, *this);
+        }
+
+    private:
+        First first;
+        Second second;
+        first_iterator first_last;
+        second_iterator second_last;
+    };
+
+    //kazdy element to widok na kolejne size elementow bazy (ostatni moze byc krotszy)
+    //widoki nie sa konstruowalne domyslnie ani przypisywalne, wiec chunki zbiera sie tylko do LinkedList
+    template <typename Base>
+    class ChunkView : public ViewBase<ChunkView<Base>> {
+        using base_iterator = typename Base::iterator;
+    public:
+        using reference = TakeView<RangeView<base_iterator>>;
+        using value_type = reference;
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename ChunkView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename ChunkView::reference;
+
+            Iterator(const base_iterator& it, const ChunkView& parent) : current(it), parent(&parent) {}
+
+            reference operator*() const {
+                if (current == parent->last) {
+                    throw std::out_of_range("Iterator out of range");
+                }
+                return reference(RangeView<base_iterator>(current, parent->last), parent->size);
+            }
+
+            Iterator& operator++() {
+                if (current == parent->last) {
+                    throw std::out_of_range("Iterator out of range");
+                }
+                for (std::size_t i = 0; i < parent->size && current != parent->last; ++i) {
+                    ++current;
+                }
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                ++(*this);
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            base_iterator current;
+            const ChunkView* parent;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        ChunkView(const Base& base, std::size_t size) : base(base), size(size), last(this->base.end()) {
+            if (size == 0) {
+                throw std::invalid_argument("Chunk size must be positive");
+            }
+        }
+
+        ChunkView(const ChunkView& other) : base(other.base), size(other.size), last(base.end()) {}
+
+        iterator begin() const {
+            return iterator(base.begin(), *this);
+        }
+
+        iterator end() const {
+            return iterator(last, *this);
+        }
+
+    private:
+        Base base;
+        std::size_t size;
+        base_iterator last;
+    };
+
+    //wymaga dwukierunkowych iteratorow bazy
+    template <typename Base>
+    class ReverseView : public ViewBase<ReverseView<Base>> {
+        using base_iterator = typename Base::iterator;
+
+        static_assert(std::is_base_of<std::bidirectional_iterator_tag, BidirectionalAtMost<base_iterator>>::value,
+                      "reverse needs a bidirectional base - take, enumerate, zip and chunk are forward only");
+    public:
+        using reference = typename Base::reference;
+        using value_type = typename Base::value_type;
+
+        class Iterator {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = typename ReverseView::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename ReverseView::reference;
+
+            explicit Iterator(const base_iterator& it) : current(it) {}
+
+            reference operator*() const {
+                base_iterator tmp = current;
+                --tmp;
+                return *tmp;
+            }
+
+            Iterator& operator++() {
+                --current;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator result = *this;
+                --current;
+                return result;
+            }
+
+            Iterator& operator--() {
+                ++current;
+                return *this;
+            }
+
+            Iterator operator--(int) {
+                Iterator result = *this;
+                ++current;
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+        private:
+            base_iterator current;
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        explicit ReverseView(const Base& base) : base(base) {}
+
+        iterator begin() const {
+            return iterator(base.end());
+        }
+
+        iterator end() const {
+            return iterator(base.begin());
+        }
+
+    private:
+        Base base;
+    };
+
+    namespace views {
+
+        template <typename Predicate>
+        struct FilterAdaptor {
+            Predicate predicate;
+        };
+
+        template <typename Function>
+        struct TransformAdaptor {
+            Function function;
+        };
+
+        template <typename Other>
+        struct ZipAdaptor {
+            Other other;
+        };
+
+        struct TakeAdaptor {
+            std::size_t count;
+        };
+
+        struct DropAdaptor {
+            std::size_t count;
+        };
+
+        struct ChunkAdaptor {
+            std::size_t size;
+        };
+
+        struct EnumerateAdaptor {};
+
+        struct ReverseAdaptor {};
+
+        template <typename Collection>
+        RangeView<typename Collection::const_iterator> all(const Collection& collection) {
+            return RangeView<typename Collection::const_iterator>(collection.begin(), collection.end());
+        }
+
+        template <typename It>
+        RangeView<It> range(const It& first, const It& last) {
+            return RangeView<It>(first, last);
+        }
+
+        template <typename Predicate>
+        FilterAdaptor<Predicate> filter(const Predicate& predicate) {
+            return FilterAdaptor<Predicate>{predicate};
+        }
+
+        template <typename Function>
+        TransformAdaptor<Function> transform(const Function& function) {
+            return TransformAdaptor<Function>{function};
+        }
+
+        template <typename Other>
+        typename std::enable_if<std::is_base_of<ViewBase<Other>, Other>::value, ZipAdaptor<Other>>::type
+        zip(const Other& other) {
+            return ZipAdaptor<Other>{other};
+        }
+
+        //kolekcja jest opakowywana w all(), zeby widok nie kopiowal jej zawartosci
+        template <typename Collection>
+        typename std::enable_if<!std::is_base_of<ViewBase<Collection>, Collection>::value,
+                                ZipAdaptor<RangeView<typename Collection::const_iterator>>>::type
+        zip(const Collection& collection) {
+            return ZipAdaptor<RangeView<typename Collection::const_iterator>>{all(collection)};
+        }
+
+        inline TakeAdaptor take(std::size_t count) {
+            return TakeAdaptor{count};
+        }
+
+        inline DropAdaptor drop(std::size_t count) {
+            return DropAdaptor{count};
+        }
+
+        inline ChunkAdaptor chunk(std::size_t size) {
+            return ChunkAdaptor{size};
+        }
+
+        inline EnumerateAdaptor enumerate() {
+            return EnumerateAdaptor{};
+        }
+
+        inline ReverseAdaptor reverse() {
+            return ReverseAdaptor{};
+        }
+
+    }
+
+    template <typename Base, typename Predicate>
+    FilterView<Base, Predicate> operator|(const ViewBase<Base>& base, const views::FilterAdaptor<Predicate>& adaptor) {
+        return FilterView<Base, Predicate>(static_cast<const Base&>(base), adaptor.predicate);
+    }
+
+    template <typename Base, typename Function>
+    TransformView<Base, Function> operator|(const ViewBase<Base>& base, const views::TransformAdaptor<Function>& adaptor) {
+        return TransformView<Base, Function>(static_cast<const Base&>(base), adaptor.function);
+    }
+
+    template <typename Base, typename Other>
+    ZipView<Base, Other> operator|(const ViewBase<Base>& base, const views::ZipAdaptor<Other>& adaptor) {
+        return ZipView<Base, Other>(static_cast<const Base&>(base), adaptor.other);
+    }
+
+    template <typename Base>
+    TakeView<Base> operator|(const ViewBase<Base>& base, const views::TakeAdaptor& adaptor) {
+        return TakeView<Base>(static_cast<const Base&>(base), adaptor.count);
+    }
+
+    template <typename Base>
+    DropView<Base> operator|(const ViewBase<Base>& base, const views::DropAdaptor& adaptor) {
+        return DropView<Base>(static_cast<const Base&>(base), adaptor.count);
+    }
+
+    template <typename Base>
+    ChunkView<Base> operator|(const ViewBase<Base>& base, const views::ChunkAdaptor& adaptor) {
+        return ChunkView<Base>(static_cast<const Base&>(base), adaptor.size);
+    }
+
+    template <typename Base>
+    EnumerateView<Base> operator|(const ViewBase<Base>& base, const views::EnumerateAdaptor&) {
+        return EnumerateView<Base>(static_cast<const Base&>(base));
+    }
+
+    template <typename Base>
+    ReverseView<Base> operator|(const ViewBase<Base>& base, const views::ReverseAdaptor&) {
+        return ReverseView<Base>(static_cast<const Base&>(base));
+    }
+
+}
+
+#endif // AISDI_LINEAR_VIEWS_H
@@ -5,9 +5,46 @@
 #include <map>
 #include <ctime>
 #include <vector>
+#include <set>
+#include <new>
+#include <malloc.h>
 
 #include "Vector.h"
+#include "Storage.h"
 #include "LinkedList.h"
+#include "Views.h"
+#include "SlotMap.h"
+#include "CompactList.h"
+#include "FlatSet.h"
+#include "StaticVector.h"
+
+//liczniki pamieci: allocated_bytes - suma wszystkich alokacji (widoki vs kolekcje posrednie),
+//live_bytes - pamiec aktualnie zajeta, razem z zaokragleniem malloca (narzut na element)
+//noinline: po wstawieniu operatorow w miejsce wywolan gcc -O2 zglasza -Wmismatched-new-delete
+static std::size_t allocated_bytes = 0;
+static std::size_t live_bytes = 0;
+
+__attribute__((noinline)) void* operator new(std::size_t size)
+{
+    allocated_bytes += size;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    live_bytes += malloc_usable_size(ptr);
+    return ptr;
+}
+
+__attribute__((noinline)) void operator delete(void* ptr) noexcept
+{
+    live_bytes -= malloc_usable_size(ptr);
+    std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
 
 namespace 
 {
@@ -45,6 +82,364 @@ namespace
 
 
 
+    struct PipelineResult
+    {
+        std::clock_t time;
+        std::size_t bytes;
+        long long checksum;
+    };
+
+    //kazdy etap tworzy nowy wektor
+    PipelineResult test_eager_pipeline(const aisdi::Vector<int>& input)
+    {
+        std::size_t bytes = allocated_bytes;
+        std::clock_t time = std::clock();
+        aisdi::Vector<int> filtered;
+        for (auto it = input.begin(); it != input.end(); ++it) {
+            if (*it % 3 != 0) {
+                filtered.append(*it);
+            }
+        }
+        aisdi::Vector<long long> transformed;
+        for (auto it = filtered.begin(); it != filtered.end(); ++it) {
+            transformed.append(static_cast<long long>(*it) * *it);
+        }
+        aisdi::Vector<long long> taken;
+        std::size_t count = 0;
+        for (auto it = transformed.begin(); it != transformed.end() && count < input.getSize() / 2; ++it, ++count) {
+            taken.append(*it);
+        }
+        long long checksum = 0;
+        for (auto it = taken.begin(); it != taken.end(); ++it) {
+            checksum += *it;
+        }
+        time = std::clock() - time;
+        return PipelineResult{time, allocated_bytes - bytes, checksum};
+    }
+
+    //te same etapy jako widoki, bez kolekcji posrednich
+    PipelineResult test_lazy_pipeline(const aisdi::Vector<int>& input)
+    {
+        using namespace aisdi::views;
+        std::size_t bytes = allocated_bytes;
+        std::clock_t time = std::clock();
+        auto pipeline = all(input)
+                        | filter([](int x) { return x % 3 != 0; })
+                        | transform([](int x) { return static_cast<long long>(x) * x; })
+                        | take(input.getSize() / 2);
+        long long checksum = 0;
+        for (auto it = pipeline.begin(); it != pipeline.end(); ++it) {
+            checksum += *it;
+        }
+        time = std::clock() - time;
+        return PipelineResult{time, allocated_bytes - bytes, checksum};
+    }
+
+    void perfomViewsTest()
+    {
+        std::vector<unsigned int> sizes{100, 5000, 50000, 500000, 5000000};
+
+        for (unsigned int size : sizes)
+        {
+            aisdi::Vector<int> input;
+            for (unsigned int i = 0; i < size; ++i) {
+                input.append(i);
+            }
+            PipelineResult eager = test_eager_pipeline(input);
+            PipelineResult lazy = test_lazy_pipeline(input);
+            std::cout << "Potok filter/transform/take, liczba elementów: " << size
+                      << " wektory posrednie: " << (float)eager.time << " (" << eager.bytes << " B)"
+                      << " widoki: " << (float)lazy.time << " (" << lazy.bytes << " B)"
+                      << (eager.checksum == lazy.checksum ? "" : " ROZNE WYNIKI") << std::endl;
+        }
+    }
+
+    template<typename Collection>
+    std::clock_t test_sequential_scan(const Collection& col, long long& checksum)
+    {
+        std::clock_t time = std::clock();
+        for (auto it = col.begin(); it != col.end(); ++it) {
+            checksum += *it;
+        }
+        return std::clock() - time;
+    }
+
+    template<typename Collection>
+    std::clock_t test_random_access(const Collection& col, long long& checksum)
+    {
+        const std::size_t size = col.getSize();
+        unsigned long long state = 12345;
+        auto first = col.begin();
+        std::clock_t time = std::clock();
+        for (std::size_t i = 0; i < size; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            checksum += *(first + (state >> 33) % size);
+        }
+        return std::clock() - time;
+    }
+
+    template<typename Collection>
+    void perfomStorageTest(const char* name, const std::vector<unsigned int>& sizes)
+    {
+        for (unsigned int size : sizes)
+        {
+            std::clock_t time = std::clock();
+            Collection col;
+            for (unsigned int i = 0; i < size; ++i) {
+                col.append(i);
+            }
+            time = std::clock() - time;
+            long long checksum = 0;
+            std::clock_t scan = test_sequential_scan(col, checksum);
+            std::clock_t random = test_random_access(col, checksum);
+            std::cout << name << ", liczba elementów: " << size << " dopisywanie: " << (float)time
+                      << " przeglad sekwencyjny: " << (float)scan << " dostep losowy: " << (float)random
+                      << " (" << checksum % 10 << ")" << std::endl;
+        }
+    }
+
+    //usuwa co trzeci element, potem sumuje pozostale
+    std::clock_t test_list_erase_scan(size_t size, long long& checksum)
+    {
+        aisdi::LinkedList<int> col;
+        for (unsigned int i = 0; i < size; ++i) {
+            col.append(i);
+        }
+        std::clock_t time = std::clock();
+        unsigned int i = 0;
+        for (auto it = col.begin(); it != col.end(); ++i) {
+            auto current = it++;
+            if (i % 3 == 0) {
+                col.erase(current);
+            }
+        }
+        for (auto it = col.begin(); it != col.end(); ++it) {
+            checksum += *it;
+        }
+        return std::clock() - time;
+    }
+
+    std::clock_t test_slotmap_erase_scan(size_t size, long long& checksum)
+    {
+        aisdi::SlotMap<int> col;
+        for (unsigned int i = 0; i < size; ++i) {
+            col.insert(i);
+        }
+        std::clock_t time = std::clock();
+        unsigned int i = 0;
+        for (auto it = col.begin(); it != col.end(); ++i) {
+            auto current = it++;
+            if (i % 3 == 0) {
+                col.erase(current);
+            }
+        }
+        for (auto it = col.begin(); it != col.end(); ++it) {
+            checksum += *it;
+        }
+        return std::clock() - time;
+    }
+
+    void perfomSlotMapTest()
+    {
+        std::vector<unsigned int> sizes{5000, 50000, 500000, 5000000};
+
+        for (unsigned int size : sizes)
+        {
+            long long list_checksum = 0;
+            long long slotmap_checksum = 0;
+            std::clock_t list_time = test_list_erase_scan(size, list_checksum);
+            std::clock_t slotmap_time = test_slotmap_erase_scan(size, slotmap_checksum);
+            std::cout << "Usuwanie co trzeciego i przeglad, liczba elementów: " << size
+                      << " lista: " << (float)list_time << " SlotMap: " << (float)slotmap_time
+                      << (list_checksum == slotmap_checksum ? "" : " ROZNE WYNIKI") << std::endl;
+        }
+    }
+
+    //wstawianie przed losowy element i losowe usuwanie - kolejnosc na liscie nie ma
+    //nic wspolnego z kolejnoscia wezlow w pamieci (ani z kolejnoscia alokacji)
+    template<typename Collection>
+    void fill_scattered(Collection& col, size_t size)
+    {
+        using handle_type = decltype(col.begin().get());
+        using iterator = typename Collection::iterator;
+        std::vector<handle_type> handles;
+        unsigned long long state = size;
+        unsigned int value = 0;
+        while (col.getSize() < size) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            size_t pick = (state >> 33) % (handles.size() + 1);
+            if (pick < handles.size() && (state >> 20) % 4 == 0) {
+                col.erase(iterator(handles[pick], col));
+                handles[pick] = handles.back();
+                handles.pop_back();
+                continue;
+            }
+            iterator position = pick < handles.size() ? iterator(handles[pick], col) : col.end();
+            col.insert(position, value++);
+            handles.push_back((position - 1).get());
+        }
+    }
+
+    void perfomCompactListTest()
+    {
+        std::vector<unsigned int> sizes{5000, 50000, 500000, 5000000};
+
+        for (unsigned int size : sizes)
+        {
+            long long checksum = 0;
+            std::size_t bytes = live_bytes;
+            aisdi::LinkedList<int> list;
+            fill_scattered(list, size);
+            std::size_t list_bytes = live_bytes - bytes;
+            std::clock_t list_time = test_sequential_scan(list, checksum);
+
+            bytes = live_bytes;
+            aisdi::CompactList<int> compact_list;
+            fill_scattered(compact_list, size);
+            std::size_t compact_bytes = live_bytes - bytes;
+            std::clock_t compact_time = test_sequential_scan(compact_list, checksum);
+            compact_list.compact();
+            std::clock_t compacted_time = test_sequential_scan(compact_list, checksum);
+
+            std::cout << "Przeglad listy, liczba elementów: " << size
+                      << " LinkedList: " << (float)list_time << " (" << list_bytes / size << " B/el.)"
+                      << " CompactList: " << (float)compact_time << " (" << compact_bytes / size << " B/el.)"
+                      << " po compact(): " << (float)compacted_time
+                      << " (" << checksum % 10 << ")" << std::endl;
+        }
+    }
+
+    std::vector<int> random_keys(size_t size, unsigned long long seed)
+    {
+        std::vector<int> keys;
+        for (size_t i = 0; i < size; ++i) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            keys.push_back(static_cast<int>(seed >> 33));
+        }
+        return keys;
+    }
+
+    template<typename Set>
+    std::clock_t test_single_insert(Set& set, const std::vector<int>& keys)
+    {
+        std::clock_t time = std::clock();
+        for (int key : keys) {
+            set.insert(key);
+        }
+        return std::clock() - time;
+    }
+
+    template<typename Set>
+    std::clock_t test_batch_insert(Set& set, const std::vector<int>& keys, size_t batch_size)
+    {
+        std::clock_t time = std::clock();
+        for (size_t i = 0; i < keys.size(); i += batch_size) {
+            set.insertBatch(keys.begin() + i, keys.begin() + std::min(i + batch_size, keys.size()));
+        }
+        return std::clock() - time;
+    }
+
+    template<typename Set>
+    std::clock_t test_lookup(const Set& set, const std::vector<int>& queries, long long& found)
+    {
+        std::clock_t time = std::clock();
+        for (int key : queries) {
+            found += set.find(key) != set.end();
+        }
+        return std::clock() - time;
+    }
+
+    void perfomFlatSetTest()
+    {
+        std::vector<unsigned int> sizes{5000, 50000, 500000, 5000000};
+        const unsigned int max_single_insert = 50000;
+
+        for (unsigned int size : sizes)
+        {
+            std::vector<int> keys = random_keys(size, size);
+            std::vector<int> queries = random_keys(size, size + 1);
+            queries.insert(queries.end(), keys.begin(), keys.begin() + size / 2);
+
+            std::cout << "FlatSet, liczba elementów: " << size << " wstawianie pojedyncze: ";
+            if (size <= max_single_insert) {
+                aisdi::FlatSet<int> single;
+                std::cout << (float)test_single_insert(single, keys);
+            }
+            else {
+                std::cout << "-";
+            }
+
+            aisdi::FlatSet<int> sorted;
+            aisdi::FlatSet<int, std::less<int>, aisdi::SearchLayout::Eytzinger> eytzinger;
+            std::set<int> node_set;
+            std::clock_t batch_time = test_batch_insert(sorted, keys, size / 10);
+            test_batch_insert(eytzinger, keys, size / 10);
+            std::clock_t set_time = test_single_insert(node_set, keys);
+
+            long long found = 0;
+            std::clock_t sorted_lookup = test_lookup(sorted, queries, found);
+            std::clock_t eytzinger_lookup = test_lookup(eytzinger, queries, found);
+            std::clock_t set_lookup = test_lookup(node_set, queries, found);
+
+            std::cout << " paczkami po " << size / 10 << ": " << (float)batch_time
+                      << " std::set: " << (float)set_time
+                      << " | wyszukiwanie binarne: " << (float)sorted_lookup
+                      << " Eytzinger: " << (float)eytzinger_lookup
+                      << " std::set: " << (float)set_lookup
+                      << " (" << found % 10 << ")" << std::endl;
+        }
+    }
+
+    //tablica budowana w czasie kompilacji
+    constexpr aisdi::StaticVector<int, 32> make_squares()
+    {
+        aisdi::StaticVector<int, 32> squares;
+        for (int i = 0; i < 32; ++i) {
+            squares.append(i * i);
+        }
+        return squares;
+    }
+
+    constexpr aisdi::StaticVector<int, 32> squares = make_squares();
+    static_assert(squares.getSize() == 32 && *(squares.begin() + 31) == 961, "squares table");
+
+    //krotkie zycie kolekcji, jak w obsludze pojedynczego zdarzenia
+    template<typename Collection>
+    std::clock_t test_short_lived(size_t repeats, long long& checksum)
+    {
+        std::clock_t time = std::clock();
+        for (size_t r = 0; r < repeats; ++r) {
+            Collection col;
+            for (int i = 0; i < 32; ++i) {
+                col.append(*(squares.begin() + i));
+            }
+            while (!col.isEmpty()) {
+                checksum += col.popLast();
+            }
+        }
+        return std::clock() - time;
+    }
+
+    void perfomStaticVectorTest()
+    {
+        std::vector<unsigned int> repeats{1000, 100000, 1000000};
+
+        for (unsigned int count : repeats)
+        {
+            long long checksum = 0;
+            std::size_t bytes = allocated_bytes;
+            std::clock_t vector_time = test_short_lived<aisdi::Vector<int>>(count, checksum);
+            std::size_t vector_bytes = allocated_bytes - bytes;
+            bytes = allocated_bytes;
+            std::clock_t static_time = test_short_lived<aisdi::StaticVector<int, 32>>(count, checksum);
+            std::size_t static_bytes = allocated_bytes - bytes;
+            std::cout << "32 x append + popLast, powtorzen: " << count
+                      << " Vector: " << (float)vector_time << " (" << vector_bytes << " B)"
+                      << " StaticVector: " << (float)static_time << " (" << static_bytes << " B)"
+                      << " (" << checksum % 10 << ")" << std::endl;
+        }
+    }
+
     void perfomTest() 
     {
         std::vector<unsigned int> sizes{100, 5000, 50000, 500000, 5000000, 10000000};
@@ -66,6 +461,33 @@ int main(int argc, char** argv)
     for (std::size_t i = 0; i < repeatCount; ++i) {
         perfomTest();
     }
+    std::cout << "Testy dla wektora z duzymi stronami: "<<std::endl;
+    std::vector<unsigned int> storage_sizes{50000, 500000, 5000000, 10000000};
+    for (std::size_t i = 0; i < repeatCount; ++i) {
+        perfomStorageTest<aisdi::Vector<int>>("new[]", storage_sizes);
+        perfomStorageTest<aisdi::Vector<int, aisdi::AlignedStorage<int, 64>>>("THP", storage_sizes);
+        perfomStorageTest<aisdi::Vector<int, aisdi::AlignedStorage<int, 64, aisdi::HugePages::Explicit>>>("MAP_HUGETLB", storage_sizes);
+    }
+    std::cout << "Testy dla SlotMap: "<<std::endl;
+    for (std::size_t i = 0; i < repeatCount; ++i) {
+        perfomSlotMapTest();
+    }
+    std::cout << "Testy dla CompactList: "<<std::endl;
+    for (std::size_t i = 0; i < repeatCount; ++i) {
+        perfomCompactListTest();
+    }
+    std::cout << "Testy dla FlatSet: "<<std::endl;
+    for (std::size_t i = 0; i < repeatCount; ++i) {
+        perfomFlatSetTest();
+    }
+    std::cout << "Testy dla StaticVector: "<<std::endl;
+    for (std::size_t i = 0; i < repeatCount; ++i) {
+        perfomStaticVectorTest();
+    }
+    std::cout << "Testy dla widokow: "<<std::endl;
+    for (std::size_t i = 0; i < repeatCount; ++i) {
+        perfomViewsTest();
+    }
 		
     
     return 0;